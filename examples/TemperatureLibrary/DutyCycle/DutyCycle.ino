@@ -0,0 +1,33 @@
+#include <Temperature.hpp>
+#include <impl/AVRInternalTemperatureSensor.hpp>
+
+// Creating reference to the sensor
+AVRInternalTemperatureSensor *sensor = new AVRInternalTemperatureSensor();
+
+void setup() {
+  Serial.begin(9600);
+
+  // Init the sensor
+  sensor->init();
+  // Power up the ADC only for a reading and convert while sleeping. Sleeping
+  // requires the build flag TEMPERATURE_LIBRARY_ADC_NOISE_REDUCTION, otherwise
+  // the conversion is done without sleeping
+  sensor->setPowerMode(
+      AVRInternalTemperatureSensor::DUTY_CYCLED_NOISE_REDUCTION);
+  // Take one reading every 10 seconds
+  sensor->setSampleInterval(10000);
+
+  Serial.println("ADC on-time per reading in µs: " +
+                 String(sensor->getOnTimePerReading()));
+}
+
+void loop() {
+  // The sleep pauses the serial transmission and millis(), so send all data
+  // before a reading is taken
+  Serial.flush();
+
+  // Take a reading, if the sample interval has elapsed
+  if (sensor->update(millis())) {
+    Serial.println("Temp in °C: " + String(sensor->getLastTemperature()));
+  }
+}
@@ -0,0 +1,33 @@
+#include <Temperature.hpp>
+#include <filter/ExponentialTemperatureFilter.hpp>
+#include <filter/KalmanTemperatureFilter.hpp>
+#include <impl/AVRInternalTemperatureSensor.hpp>
+
+// Creating reference to the sensor
+AVRInternalTemperatureSensor *sensor = new AVRInternalTemperatureSensor();
+// Wrapping the sensor into an exponential filter with a smoothing factor of
+// 1/2^4 = 1/16
+ExponentialTemperatureFilter *exponentialFilter =
+    new ExponentialTemperatureFilter(sensor, 4);
+// Wrapping the same sensor into a Kalman filter, which expects the temperature
+// change to be 1/100 of the noise of the sensor
+KalmanTemperatureFilter *kalmanFilter =
+    new KalmanTemperatureFilter(sensor, 1, 100);
+
+void setup() {
+  Serial.begin(9600);
+
+  // Init the filters, which also inits the wrapped sensor
+  exponentialFilter->init();
+  kalmanFilter->init();
+}
+
+void loop() {
+  // Each filter takes its own reading from the sensor
+  Serial.println("Exponential filtered temp in °C: " +
+                 String(exponentialFilter->getTemperature()));
+  Serial.println("Kalman filtered temp in °C: " +
+                 String(kalmanFilter->getTemperature()));
+  Serial.println();
+  delay(500);
+}
@@ -25,6 +25,8 @@
 
 #include "Temperature.hpp"
 
+#include <math.h>
+
 #if defined(CHAR_PTR_STRING)
 #include <avr/pgmspace.h>
 #define F(s) ((String)PSTR(s))
@@ -36,6 +38,81 @@
 #include <Print.h>
 #endif
 
+/*
+ * Selection of the units that are compiled into the conversion and string
+ * methods. If none of the TEMPERATURE_LIBRARY_UNIT_<NAME> macros is defined
+ * as global build flag, every unit is available. Otherwise only the defined
+ * units are supported, which saves flash memory on small microcontrollers.
+ * Converting from or into an unsupported unit returns NAN and the unit string
+ * of an unsupported unit is empty.
+ */
+#if defined(TEMPERATURE_LIBRARY_UNIT_CELSIUS) ||                               \
+    defined(TEMPERATURE_LIBRARY_UNIT_FAHRENHEIT) ||                            \
+    defined(TEMPERATURE_LIBRARY_UNIT_KELVIN) ||                                \
+    defined(TEMPERATURE_LIBRARY_UNIT_RANKINE) ||                               \
+    defined(TEMPERATURE_LIBRARY_UNIT_DELISLE) ||                               \
+    defined(TEMPERATURE_LIBRARY_UNIT_REAUMUR) ||                               \
+    defined(TEMPERATURE_LIBRARY_UNIT_NEWTON) ||                                \
+    defined(TEMPERATURE_LIBRARY_UNIT_ROMER)
+#define TEMPERATURE_LIBRARY_UNITS_SELECTED
+#endif
+
+#if !defined(TEMPERATURE_LIBRARY_UNITS_SELECTED) ||                            \
+    defined(TEMPERATURE_LIBRARY_UNIT_CELSIUS)
+#define TEMPERATURE_LIBRARY_HAS_CELSIUS 1
+#else
+#define TEMPERATURE_LIBRARY_HAS_CELSIUS 0
+#endif
+
+#if !defined(TEMPERATURE_LIBRARY_UNITS_SELECTED) ||                            \
+    defined(TEMPERATURE_LIBRARY_UNIT_FAHRENHEIT)
+#define TEMPERATURE_LIBRARY_HAS_FAHRENHEIT 1
+#else
+#define TEMPERATURE_LIBRARY_HAS_FAHRENHEIT 0
+#endif
+
+#if !defined(TEMPERATURE_LIBRARY_UNITS_SELECTED) ||                            \
+    defined(TEMPERATURE_LIBRARY_UNIT_KELVIN)
+#define TEMPERATURE_LIBRARY_HAS_KELVIN 1
+#else
+#define TEMPERATURE_LIBRARY_HAS_KELVIN 0
+#endif
+
+#if !defined(TEMPERATURE_LIBRARY_UNITS_SELECTED) ||                            \
+    defined(TEMPERATURE_LIBRARY_UNIT_RANKINE)
+#define TEMPERATURE_LIBRARY_HAS_RANKINE 1
+#else
+#define TEMPERATURE_LIBRARY_HAS_RANKINE 0
+#endif
+
+#if !defined(TEMPERATURE_LIBRARY_UNITS_SELECTED) ||                            \
+    defined(TEMPERATURE_LIBRARY_UNIT_DELISLE)
+#define TEMPERATURE_LIBRARY_HAS_DELISLE 1
+#else
+#define TEMPERATURE_LIBRARY_HAS_DELISLE 0
+#endif
+
+#if !defined(TEMPERATURE_LIBRARY_UNITS_SELECTED) ||                            \
+    defined(TEMPERATURE_LIBRARY_UNIT_REAUMUR)
+#define TEMPERATURE_LIBRARY_HAS_REAUMUR 1
+#else
+#define TEMPERATURE_LIBRARY_HAS_REAUMUR 0
+#endif
+
+#if !defined(TEMPERATURE_LIBRARY_UNITS_SELECTED) ||                            \
+    defined(TEMPERATURE_LIBRARY_UNIT_NEWTON)
+#define TEMPERATURE_LIBRARY_HAS_NEWTON 1
+#else
+#define TEMPERATURE_LIBRARY_HAS_NEWTON 0
+#endif
+
+#if !defined(TEMPERATURE_LIBRARY_UNITS_SELECTED) ||                            \
+    defined(TEMPERATURE_LIBRARY_UNIT_ROMER)
+#define TEMPERATURE_LIBRARY_HAS_ROMER 1
+#else
+#define TEMPERATURE_LIBRARY_HAS_ROMER 0
+#endif
+
 String Temperature::getTemperatureString() {
   return getTemperatureString(this->value, this->unit);
 }
@@ -77,16 +154,28 @@ void Temperature::setUnit(Temperature::Unit unit) {
   this->unit = unit;
 }
 
+bool Temperature::isUnitSupported(Unit unit) {
+  return unit == CELSIUS      ? TEMPERATURE_LIBRARY_HAS_CELSIUS
+         : unit == FAHRENHEIT ? TEMPERATURE_LIBRARY_HAS_FAHRENHEIT
+         : unit == KELVIN     ? TEMPERATURE_LIBRARY_HAS_KELVIN
+         : unit == RANKINE    ? TEMPERATURE_LIBRARY_HAS_RANKINE
+         : unit == DELISLE    ? TEMPERATURE_LIBRARY_HAS_DELISLE
+         : unit == REAUMUR    ? TEMPERATURE_LIBRARY_HAS_REAUMUR
+         : unit == NEWTON     ? TEMPERATURE_LIBRARY_HAS_NEWTON
+         : unit == ROMER      ? TEMPERATURE_LIBRARY_HAS_ROMER
+                              : false;
+}
+
 String Temperature::getUnitString(Unit unit) {
-  return unit == CELSIUS      ? F("°C")
-         : unit == FAHRENHEIT ? F("°F")
-         : unit == KELVIN     ? F("K")
-         : unit == RANKINE    ? F("°R")
-         : unit == DELISLE    ? F("°D")
-         : unit == REAUMUR    ? F("°R")
-         : unit == NEWTON     ? F("°N")
-         : unit == ROMER      ? F("°Rø")
-                              : F("");
+  return TEMPERATURE_LIBRARY_HAS_CELSIUS && unit == CELSIUS         ? F("°C")
+         : TEMPERATURE_LIBRARY_HAS_FAHRENHEIT && unit == FAHRENHEIT ? F("°F")
+         : TEMPERATURE_LIBRARY_HAS_KELVIN && unit == KELVIN         ? F("K")
+         : TEMPERATURE_LIBRARY_HAS_RANKINE && unit == RANKINE       ? F("°R")
+         : TEMPERATURE_LIBRARY_HAS_DELISLE && unit == DELISLE       ? F("°D")
+         : TEMPERATURE_LIBRARY_HAS_REAUMUR && unit == REAUMUR       ? F("°R")
+         : TEMPERATURE_LIBRARY_HAS_NEWTON && unit == NEWTON         ? F("°N")
+         : TEMPERATURE_LIBRARY_HAS_ROMER && unit == ROMER           ? F("°Rø")
+                                                                    : F("");
 }
 
 float Temperature::convertTo(Unit unit) {
@@ -95,132 +184,138 @@ float Temperature::convertTo(Unit unit) {
 
 /** Conversions from: http://www.alcula.com/conversion/temperature */
 float Temperature::convertTo(float value, Unit unitFrom, Unit unitTo) {
-  if (unitFrom == CELSIUS) {
-    if (unitTo == FAHRENHEIT) {
+  if (!isUnitSupported(unitFrom) || !isUnitSupported(unitTo)) {
+    return NAN;
+  }
+
+  /// Branches of unsupported units are constant false and removed by the
+  /// compiler
+  if (TEMPERATURE_LIBRARY_HAS_CELSIUS && unitFrom == CELSIUS) {
+    if (TEMPERATURE_LIBRARY_HAS_FAHRENHEIT && unitTo == FAHRENHEIT) {
       return value * 9 / 5 + 32;
-    } else if (unitTo == KELVIN) {
+    } else if (TEMPERATURE_LIBRARY_HAS_KELVIN && unitTo == KELVIN) {
       return value + (float)273.15;
-    } else if (unitTo == RANKINE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_RANKINE && unitTo == RANKINE) {
       return (value + (float)273.15) * 9 / 5;
-    } else if (unitTo == DELISLE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_DELISLE && unitTo == DELISLE) {
       return (100 - value) * 3 / 2;
-    } else if (unitTo == REAUMUR) {
+    } else if (TEMPERATURE_LIBRARY_HAS_REAUMUR && unitTo == REAUMUR) {
       return value * 4 / 5;
-    } else if (unitTo == NEWTON) {
+    } else if (TEMPERATURE_LIBRARY_HAS_NEWTON && unitTo == NEWTON) {
       return value * 33 / 100;
-    } else if (unitTo == ROMER) {
+    } else if (TEMPERATURE_LIBRARY_HAS_ROMER && unitTo == ROMER) {
       return value * 21 / 40 + (float)7.5;
     }
-  } else if (unitFrom == FAHRENHEIT) {
-    if (unitTo == CELSIUS) {
+  } else if (TEMPERATURE_LIBRARY_HAS_FAHRENHEIT && unitFrom == FAHRENHEIT) {
+    if (TEMPERATURE_LIBRARY_HAS_CELSIUS && unitTo == CELSIUS) {
       return (value - 32) * 5 / 9;
-    } else if (unitTo == KELVIN) {
+    } else if (TEMPERATURE_LIBRARY_HAS_KELVIN && unitTo == KELVIN) {
       return (value + (float)459.67) * 5 / 9;
-    } else if (unitTo == RANKINE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_RANKINE && unitTo == RANKINE) {
       return value + (float)459.67;
-    } else if (unitTo == DELISLE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_DELISLE && unitTo == DELISLE) {
       return (212 - value) * 5 / 6;
-    } else if (unitTo == REAUMUR) {
+    } else if (TEMPERATURE_LIBRARY_HAS_REAUMUR && unitTo == REAUMUR) {
       return (value - 32) * 4 / 9;
-    } else if (unitTo == NEWTON) {
+    } else if (TEMPERATURE_LIBRARY_HAS_NEWTON && unitTo == NEWTON) {
       return (value - 32) * 11 / 60;
-    } else if (unitTo == ROMER) {
+    } else if (TEMPERATURE_LIBRARY_HAS_ROMER && unitTo == ROMER) {
       return (value - 32) * 7 / 24 + (float)7.5;
     }
-  } else if (unitFrom == KELVIN) {
-    if (unitTo == CELSIUS) {
+  } else if (TEMPERATURE_LIBRARY_HAS_KELVIN && unitFrom == KELVIN) {
+    if (TEMPERATURE_LIBRARY_HAS_CELSIUS && unitTo == CELSIUS) {
       return value - (float)273.15;
-    } else if (unitTo == FAHRENHEIT) {
+    } else if (TEMPERATURE_LIBRARY_HAS_FAHRENHEIT && unitTo == FAHRENHEIT) {
       return (value * 9 / 5) - (float)459.67;
-    } else if (unitTo == RANKINE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_RANKINE && unitTo == RANKINE) {
       return value * 9 / 5;
-    } else if (unitTo == DELISLE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_DELISLE && unitTo == DELISLE) {
       return ((float)373.15 - value) * 3 / 2;
-    } else if (unitTo == REAUMUR) {
+    } else if (TEMPERATURE_LIBRARY_HAS_REAUMUR && unitTo == REAUMUR) {
       return (value - (float)273.15) * 4 / 5;
-    } else if (unitTo == NEWTON) {
+    } else if (TEMPERATURE_LIBRARY_HAS_NEWTON && unitTo == NEWTON) {
       return (value - (float)273.15) * 33 / 100;
-    } else if (unitTo == ROMER) {
+    } else if (TEMPERATURE_LIBRARY_HAS_ROMER && unitTo == ROMER) {
       return (value - (float)273.15) * 21 / 40 + (float)7.5;
     }
-  } else if (unitFrom == RANKINE) {
-    if (unitTo == CELSIUS) {
+  } else if (TEMPERATURE_LIBRARY_HAS_RANKINE && unitFrom == RANKINE) {
+    if (TEMPERATURE_LIBRARY_HAS_CELSIUS && unitTo == CELSIUS) {
       return (value - (float)491.67) * 5 / 9;
-    } else if (unitTo == FAHRENHEIT) {
+    } else if (TEMPERATURE_LIBRARY_HAS_FAHRENHEIT && unitTo == FAHRENHEIT) {
       return value - (float)459.67;
-    } else if (unitTo == KELVIN) {
+    } else if (TEMPERATURE_LIBRARY_HAS_KELVIN && unitTo == KELVIN) {
       return value * 5 / 9;
-    } else if (unitTo == DELISLE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_DELISLE && unitTo == DELISLE) {
       return ((float)671.67 - value) * 5 / 6;
-    } else if (unitTo == REAUMUR) {
+    } else if (TEMPERATURE_LIBRARY_HAS_REAUMUR && unitTo == REAUMUR) {
       return (value - (float)491.67) * 4 / 9;
-    } else if (unitTo == NEWTON) {
+    } else if (TEMPERATURE_LIBRARY_HAS_NEWTON && unitTo == NEWTON) {
       return (value - (float)491.67) * 11 / 60;
-    } else if (unitTo == ROMER) {
+    } else if (TEMPERATURE_LIBRARY_HAS_ROMER && unitTo == ROMER) {
       return (value - (float)491.67) * 7 / 24 + (float)7.5;
     }
-  } else if (unitFrom == DELISLE) {
-    if (unitTo == CELSIUS) {
+  } else if (TEMPERATURE_LIBRARY_HAS_DELISLE && unitFrom == DELISLE) {
+    if (TEMPERATURE_LIBRARY_HAS_CELSIUS && unitTo == CELSIUS) {
       return 100 - value * 2 / 3;
-    } else if (unitTo == FAHRENHEIT) {
+    } else if (TEMPERATURE_LIBRARY_HAS_FAHRENHEIT && unitTo == FAHRENHEIT) {
       return 212 - value * 6 / 5;
-    } else if (unitTo == KELVIN) {
+    } else if (TEMPERATURE_LIBRARY_HAS_KELVIN && unitTo == KELVIN) {
       return (float)373.15 - (value * 2 / 3);
-    } else if (unitTo == RANKINE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_RANKINE && unitTo == RANKINE) {
       return (float)671.76 - value * 6 / 5;
-    } else if (unitTo == REAUMUR) {
+    } else if (TEMPERATURE_LIBRARY_HAS_REAUMUR && unitTo == REAUMUR) {
       return 80 - value * 8 / 15;
-    } else if (unitTo == NEWTON) {
+    } else if (TEMPERATURE_LIBRARY_HAS_NEWTON && unitTo == NEWTON) {
       return 33 - value * 11 / 50;
-    } else if (unitTo == ROMER) {
+    } else if (TEMPERATURE_LIBRARY_HAS_ROMER && unitTo == ROMER) {
       return 60 - value * 7 / 20;
     }
-  } else if (unitFrom == REAUMUR) {
-    if (unitTo == CELSIUS) {
+  } else if (TEMPERATURE_LIBRARY_HAS_REAUMUR && unitFrom == REAUMUR) {
+    if (TEMPERATURE_LIBRARY_HAS_CELSIUS && unitTo == CELSIUS) {
       return value * 5 / 4;
-    } else if (unitTo == FAHRENHEIT) {
+    } else if (TEMPERATURE_LIBRARY_HAS_FAHRENHEIT && unitTo == FAHRENHEIT) {
       return value * 9 / 4 + 32;
-    } else if (unitTo == KELVIN) {
+    } else if (TEMPERATURE_LIBRARY_HAS_KELVIN && unitTo == KELVIN) {
       return value * 5 / 4 + (float)273.15;
-    } else if (unitTo == RANKINE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_RANKINE && unitTo == RANKINE) {
       return value * 9 / 4 + (float)491.67;
-    } else if (unitTo == DELISLE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_DELISLE && unitTo == DELISLE) {
       return (80 - value) * 15 / 4;
-    } else if (unitTo == NEWTON) {
+    } else if (TEMPERATURE_LIBRARY_HAS_NEWTON && unitTo == NEWTON) {
       return value * 33 / 80;
-    } else if (unitTo == ROMER) {
+    } else if (TEMPERATURE_LIBRARY_HAS_ROMER && unitTo == ROMER) {
       return value * 21 / 32 + (float)7.5;
     }
-  } else if (unitFrom == NEWTON) {
-    if (unitTo == CELSIUS) {
+  } else if (TEMPERATURE_LIBRARY_HAS_NEWTON && unitFrom == NEWTON) {
+    if (TEMPERATURE_LIBRARY_HAS_CELSIUS && unitTo == CELSIUS) {
       return value * 100 / 33;
-    } else if (unitTo == FAHRENHEIT) {
+    } else if (TEMPERATURE_LIBRARY_HAS_FAHRENHEIT && unitTo == FAHRENHEIT) {
       return value * 60 / 11 + 32;
-    } else if (unitTo == KELVIN) {
+    } else if (TEMPERATURE_LIBRARY_HAS_KELVIN && unitTo == KELVIN) {
       return value * 100 / 33 + (float)273.15;
-    } else if (unitTo == RANKINE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_RANKINE && unitTo == RANKINE) {
       return value * 60 / 11 + (float)491.67;
-    } else if (unitTo == DELISLE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_DELISLE && unitTo == DELISLE) {
       return (33 - value) * 50 / 11;
-    } else if (unitTo == REAUMUR) {
+    } else if (TEMPERATURE_LIBRARY_HAS_REAUMUR && unitTo == REAUMUR) {
       return value * 80 / 33;
-    } else if (unitTo == ROMER) {
+    } else if (TEMPERATURE_LIBRARY_HAS_ROMER && unitTo == ROMER) {
       return value * 35 / 22 + (float)7.5;
     }
-  } else if (unitFrom == ROMER) {
-    if (unitTo == CELSIUS) {
+  } else if (TEMPERATURE_LIBRARY_HAS_ROMER && unitFrom == ROMER) {
+    if (TEMPERATURE_LIBRARY_HAS_CELSIUS && unitTo == CELSIUS) {
       return (value - (float)7.5) * 40 / 21;
-    } else if (unitTo == FAHRENHEIT) {
+    } else if (TEMPERATURE_LIBRARY_HAS_FAHRENHEIT && unitTo == FAHRENHEIT) {
       return (value - (float)7.5) * 24 / 7 + 32;
-    } else if (unitTo == KELVIN) {
+    } else if (TEMPERATURE_LIBRARY_HAS_KELVIN && unitTo == KELVIN) {
       return (value - (float)7.5) * 40 / 21 + (float)273.15;
-    } else if (unitTo == RANKINE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_RANKINE && unitTo == RANKINE) {
       return (value - (float)7.5) * 24 / 7 + (float)491.67;
-    } else if (unitTo == DELISLE) {
+    } else if (TEMPERATURE_LIBRARY_HAS_DELISLE && unitTo == DELISLE) {
       return (60 - value) * 20 / 7;
-    } else if (unitTo == REAUMUR) {
+    } else if (TEMPERATURE_LIBRARY_HAS_REAUMUR && unitTo == REAUMUR) {
       return (value - (float)7.5) * 32 / 21;
-    } else if (unitTo == NEWTON) {
+    } else if (TEMPERATURE_LIBRARY_HAS_NEWTON && unitTo == NEWTON) {
       return (value - (float)7.5) * 22 / 35;
     }
   }
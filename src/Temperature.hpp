@@ -57,6 +57,14 @@ typedef unsigned char *String;
 #endif
 #endif
 
+/*
+ * The units compiled into the conversion and string methods can be restricted
+ * with TEMPERATURE_LIBRARY_UNIT_<NAME> macros to save flash memory (see
+ * Temperature.cpp). They have to be global build flags, because the selection
+ * is done when compiling Temperature.cpp. Defining them in a sketch before
+ * including this header has no effect.
+ */
+
 /*!
  * @brief   Class representing a temperature, but this also includes some static
  * methods for handling temperatures (for example convert temperatures into
@@ -150,11 +158,21 @@ public:
    */
   Unit getUnit() { return unit; };
 
+  /*!
+   * @brief Check if a unit is supported by the conversion and string methods
+   * (see TEMPERATURE_LIBRARY_UNIT_<NAME>).
+   *
+   * @param unit    Unit
+   * @return    True, if the unit is supported.
+   */
+  static bool isUnitSupported(Unit unit);
+
   /*!
    * @brief Get a string representation of a unit.
    *
    * @param unit    Unit
-   * @return    A string representation of a unit.
+   * @return    A string representation of a unit. Empty, if the unit is not
+   *            supported (see TEMPERATURE_LIBRARY_UNIT_<NAME>).
    */
   static String getUnitString(Unit unit);
 
@@ -171,7 +189,9 @@ public:
    * @param value       Temperature value
    * @param unitFrom    Unit from that the value should be converted
    * @param unitTo      Unit in that the value should be converted
-   * @return    Value of the converted temperature.
+   * @return    Value of the converted temperature. If one of the units is not
+   *            supported (see TEMPERATURE_LIBRARY_UNIT_<NAME>), NAN is
+   *            returned.
    */
   static float convertTo(float value, Unit unitFrom, Unit unitTo);
 
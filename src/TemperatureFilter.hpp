@@ -0,0 +1,107 @@
+/*!
+ * @file TemperatureFilter.hpp
+ *
+ * The library can be used to compute temperatures into different units, to
+ * retrieve temperatures from different sensors and to write own implementation
+ * of temperature sensors.
+ *
+ * Copyright (C) 2023  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef TEMPERATURE_LIBRARY_TEMPERATUREFILTER_HPP
+#define TEMPERATURE_LIBRARY_TEMPERATUREFILTER_HPP
+
+#include "TemperatureSensor.hpp"
+
+#include <stdint.h>
+
+/*!
+ * @brief   Abstract class from which all filter stages can be derived. A filter
+ * wraps any temperature sensor and behaves like a sensor itself, so filters
+ * can also be chained. The filtering is done in fixed-point arithmetic with
+ * FRACTION_BITS fractional bits, only the conversion of the wrapped reading and
+ * of the result uses floats.
+ */
+class TemperatureFilter : public TemperatureSensor {
+protected:
+  static const uint8_t FRACTION_BITS =
+      6; /// Fractional bits of the fixed-point temperature (1/64 degree)
+
+  TemperatureSensor *sensor; /// Wrapped sensor, which is not owned
+  bool initialised = false;  /// True, if the filter holds a state
+
+  /*!
+   * @brief Constructor of a filter wrapping a sensor.
+   *
+   * @param sensor  Sensor whose readings should be filtered.
+   */
+  explicit TemperatureFilter(TemperatureSensor *sensor) : sensor(sensor){};
+
+  /*!
+   * @brief Feed a reading into the filter.
+   *
+   * @param value   Reading in fixed-point representation.
+   * @return The filtered value in fixed-point representation.
+   */
+  virtual int32_t filter(int32_t value) = 0;
+
+public:
+  /*!
+   * @brief Initialise the wrapped sensor and reset the filter.
+   */
+  void init() override {
+    sensor->init();
+    reset();
+  }
+
+  /*!
+   * @brief Reset the filter. The next reading is taken as the initial state.
+   */
+  void reset() { initialised = false; }
+
+  /*!
+   * @copydoc TemperatureSensor::getDefaultUnit()
+   */
+  Temperature::Unit getDefaultUnit() override {
+    return sensor->getDefaultUnit();
+  }
+
+  /*!
+   * @brief Get the filtered temperature of the wrapped sensor.
+   *
+   * @return Filtered temperature value
+   */
+  float getTemperature() override {
+    float value = sensor->getTemperature() * (1 << FRACTION_BITS);
+    int32_t filtered =
+        filter((int32_t)(value < 0 ? value - (float)0.5 : value + (float)0.5));
+    return (float)filtered / (1 << FRACTION_BITS);
+  }
+
+  /*!
+   * @copydoc TemperatureSensor::saveState()
+   */
+  void saveState() override { sensor->saveState(); }
+
+  /*!
+   * @copydoc TemperatureSensor::restoreState()
+   */
+  void restoreState() override { sensor->restoreState(); }
+};
+
+#endif // TEMPERATURE_LIBRARY_TEMPERATUREFILTER_HPP
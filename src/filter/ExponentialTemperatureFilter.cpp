@@ -0,0 +1,46 @@
+/*!
+ * @file filter/ExponentialTemperatureFilter.cpp
+ *
+ * The library can be used to compute temperatures into different units, to
+ * retrieve temperatures from different sensors and to write own implementation
+ * of temperature sensors.
+ *
+ * Copyright (C) 2023  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#include "ExponentialTemperatureFilter.hpp"
+
+int32_t ExponentialTemperatureFilter::filter(int32_t value) {
+  if (shift == 0) {
+    return value;
+  }
+
+  /// Half of the scaling, for rounding to the nearest value
+  int32_t half = (int32_t)1 << (shift - 1);
+
+  if (!initialised) {
+    accumulator = value * ((int32_t)1 << shift);
+    initialised = true;
+  } else {
+    /// The feedback is rounded as well, otherwise the output would keep an
+    /// offset after a falling step
+    accumulator += value - ((accumulator + half) >> shift);
+  }
+
+  return (accumulator + half) >> shift;
+}
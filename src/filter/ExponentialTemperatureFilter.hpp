@@ -0,0 +1,61 @@
+/*!
+ * @file filter/ExponentialTemperatureFilter.hpp
+ *
+ * The library can be used to compute temperatures into different units, to
+ * retrieve temperatures from different sensors and to write own implementation
+ * of temperature sensors.
+ *
+ * Copyright (C) 2023  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef ARDUINO_TEMPERATURE_EXPONENTIALTEMPERATUREFILTER_HPP
+#define ARDUINO_TEMPERATURE_EXPONENTIALTEMPERATUREFILTER_HPP
+
+#include "TemperatureFilter.hpp"
+
+/*!
+ * @brief   Exponential moving average filter with a smoothing factor of
+ * 2^-shift. Each reading moves the output by 1/2^shift of the difference
+ * between the reading and the current output. The readings have to be between
+ * -1024 and 1024 degrees.
+ */
+class ExponentialTemperatureFilter : public TemperatureFilter {
+private:
+  uint8_t shift;       /// Smoothing factor as power of two
+  int32_t accumulator; /// Filtered value scaled by 2^shift
+
+protected:
+  /*!
+   * @copydoc TemperatureFilter::filter()
+   */
+  int32_t filter(int32_t value) override;
+
+public:
+  /*!
+   * @brief Constructor of an exponential filter wrapping a sensor.
+   *
+   * @param sensor  Sensor whose readings should be filtered.
+   * @param shift   Smoothing factor as power of two (0 to 14). A higher value
+   *                means a stronger smoothing and a slower response.
+   */
+  ExponentialTemperatureFilter(TemperatureSensor *sensor, uint8_t shift)
+      : TemperatureFilter(sensor), shift(shift > 14 ? 14 : shift),
+        accumulator(){};
+};
+
+#endif // ARDUINO_TEMPERATURE_EXPONENTIALTEMPERATUREFILTER_HPP
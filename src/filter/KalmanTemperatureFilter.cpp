@@ -0,0 +1,60 @@
+/*!
+ * @file filter/KalmanTemperatureFilter.cpp
+ *
+ * The library can be used to compute temperatures into different units, to
+ * retrieve temperatures from different sensors and to write own implementation
+ * of temperature sensors.
+ *
+ * Copyright (C) 2023  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#include "KalmanTemperatureFilter.hpp"
+
+int32_t KalmanTemperatureFilter::filter(int32_t value) {
+  if (!initialised) {
+    estimate = value * ((int32_t)1 << ESTIMATE_BITS);
+    errorCovariance = measurementNoise;
+    initialised = true;
+    return value;
+  }
+
+  /// Prediction: the temperature is expected to stay the same, but the
+  /// uncertainty grows. The covariance stays below 2^17, so every product
+  /// fits into 32 bits.
+  errorCovariance += processNoise;
+
+  /// Correction. The product of gain and difference is split into a high and a
+  /// low part, so it does not overflow 32 bits.
+  int32_t gain = (int32_t)((errorCovariance << GAIN_BITS) /
+                           (errorCovariance + measurementNoise));
+  int32_t difference = value * ((int32_t)1 << ESTIMATE_BITS) - estimate;
+  int32_t differenceLow = difference & (((int32_t)1 << GAIN_BITS) - 1);
+  estimate += gain * (difference >> GAIN_BITS) +
+              ((gain * differenceLow + ((int32_t)1 << (GAIN_BITS - 1))) >>
+               GAIN_BITS);
+  errorCovariance -= ((uint32_t)gain * errorCovariance) >> GAIN_BITS;
+
+  /// Without process noise the covariance would drop to 0 and the filter
+  /// would not follow any change anymore
+  if (errorCovariance == 0) {
+    errorCovariance = 1;
+  }
+
+  /// Round to the nearest value
+  return (estimate + ((int32_t)1 << (ESTIMATE_BITS - 1))) >> ESTIMATE_BITS;
+}
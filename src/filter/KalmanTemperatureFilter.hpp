@@ -0,0 +1,69 @@
+/*!
+ * @file filter/KalmanTemperatureFilter.hpp
+ *
+ * The library can be used to compute temperatures into different units, to
+ * retrieve temperatures from different sensors and to write own implementation
+ * of temperature sensors.
+ *
+ * Copyright (C) 2023  Niklas Kaaf
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+
+#ifndef ARDUINO_TEMPERATURE_KALMANTEMPERATUREFILTER_HPP
+#define ARDUINO_TEMPERATURE_KALMANTEMPERATUREFILTER_HPP
+
+#include "TemperatureFilter.hpp"
+
+/*!
+ * @brief   Scalar Kalman filter for a slowly changing temperature. The noises
+ * are given in the same arbitrary unit, only their ratio matters: a lower
+ * process noise compared to the measurement noise means a stronger smoothing.
+ * The readings have to be between -1024 and 1024 degrees.
+ */
+class KalmanTemperatureFilter : public TemperatureFilter {
+private:
+  static const uint8_t GAIN_BITS = 14; /// Fractional bits of the Kalman gain
+  static const uint8_t ESTIMATE_BITS =
+      12; /// Additional fractional bits of the estimate
+
+  uint16_t processNoise;     /// Variance of the temperature change per reading
+  uint16_t measurementNoise; /// Variance of the sensor readings
+  uint32_t errorCovariance;  /// Variance of the estimation
+  int32_t estimate;          /// Estimated temperature scaled by 2^ESTIMATE_BITS
+
+protected:
+  /*!
+   * @copydoc TemperatureFilter::filter()
+   */
+  int32_t filter(int32_t value) override;
+
+public:
+  /*!
+   * @brief Constructor of a Kalman filter wrapping a sensor.
+   *
+   * @param sensor              Sensor whose readings should be filtered.
+   * @param processNoise        Variance of the temperature change per reading.
+   * @param measurementNoise    Variance of the sensor readings (at least 1).
+   */
+  KalmanTemperatureFilter(TemperatureSensor *sensor, uint16_t processNoise,
+                          uint16_t measurementNoise)
+      : TemperatureFilter(sensor), processNoise(processNoise),
+        measurementNoise(measurementNoise == 0 ? 1 : measurementNoise),
+        errorCovariance(), estimate(){};
+};
+
+#endif // ARDUINO_TEMPERATURE_KALMANTEMPERATUREFILTER_HPP
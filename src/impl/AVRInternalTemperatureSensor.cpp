@@ -26,7 +26,27 @@
 #include "AVRInternalTemperatureSensor.hpp"
 
 #include "stdlib.h"
+#include "avr/interrupt.h"
 #include "avr/io.h"
+#include "avr/power.h"
+#include "avr/sleep.h"
+
+/// ADC clock prescaler select bits, dividing the clock by 64
+static const uint8_t ADC_PRESCALER_BITS = (1 << ADPS2) | (1 << ADPS1);
+/// Division factor of the ADC clock, which is 2^ADPS
+static const uint8_t ADC_PRESCALER = 1 << (ADC_PRESCALER_BITS >> ADPS0);
+/// ADC clock cycles of the first conversion after enabling the ADC
+static const uint8_t ADC_CYCLES_FIRST_CONVERSION = 25;
+/// ADC clock cycles of a normal conversion
+static const uint8_t ADC_CYCLES_CONVERSION = 13;
+
+#if defined(TEMPERATURE_LIBRARY_ADC_NOISE_REDUCTION) &&                        \
+    !defined(TEMPERATURE_LIBRARY_NO_ADC_INTERRUPT)
+/// Wake up from the ADC Noise Reduction sleep mode. Define
+/// TEMPERATURE_LIBRARY_NO_ADC_INTERRUPT, if the ADC_vect interrupt is
+/// implemented elsewhere.
+EMPTY_INTERRUPT(ADC_vect);
+#endif
 
 Linear2DRegression *AVRInternalTemperatureSensor::linearRegression =
     new Linear2DRegression();
@@ -54,10 +74,50 @@ void AVRInternalTemperatureSensor::initRegression() {
 #endif
 }
 
+void AVRInternalTemperatureSensor::convert() {
+#if defined(TEMPERATURE_LIBRARY_ADC_NOISE_REDUCTION) && defined(SLEEP_MODE_ADC)
+  uint8_t sreg = SREG;
+
+  /// Sleeping needs the ADC interrupt for waking up. If the caller disabled
+  /// the interrupts (e.g. in an ISR or an atomic block), they are not enabled
+  /// here and the conversion is done without sleeping.
+  if (powerMode == DUTY_CYCLED_NOISE_REDUCTION && (sreg & (1 << SREG_I)) != 0) {
+    /// Activate ADC with interrupt, which wakes up the MCU
+    ADCSRA |= (1 << ADIE) | (1 << ADSC);
+    set_sleep_mode(SLEEP_MODE_ADC);
+    sleep_enable();
+
+    /// Sleep until conversion is finished. Other interrupts can also wake up
+    /// the MCU, so the check is done with disabled interrupts to not miss the
+    /// end of the conversion.
+    while (true) {
+      cli();
+      if ((ADCSRA & (1 << ADSC)) == 0) {
+        break;
+      }
+      sei();
+      sleep_cpu();
+    }
+
+    sleep_disable();
+    ADCSRA &= ~(1 << ADIE);
+    SREG = sreg;
+    return;
+  }
+#endif
+
+  /// Activate ADC
+  ADCSRA |= (1 << ADSC);
+
+  /// Wait until conversion is finished
+  while ((ADCSRA & (1 << ADSC)) != 0) {
+  }
+}
+
 float AVRInternalTemperatureSensor::getTemperature() {
 #if defined(__AVR_HAVE_PRR_PRADC)
-  /// Shut down the Power Reduction ADC bit
-  PRR |= (0 << PRADC);
+  /// Clear the Power Reduction ADC bit
+  power_adc_enable();
 #endif
 
 #if defined(__AVR_ATmega48A__) || defined(__AVR_ATmega48PA__) ||               \
@@ -73,21 +133,50 @@ float AVRInternalTemperatureSensor::getTemperature() {
   ADMUXB = (1 << REFS);
 #endif
 
-  /// Activate and enable ADC
-  ADCSRA = (1 << ADEN) | (1 << ADSC) | (1 << ADPS2) | (1 << ADPS1);
+  /// Enable ADC
+  ADCSRA = (1 << ADEN) | ADC_PRESCALER_BITS;
 
-  /// Wait until one conversion is finished (= initialization of the ADC)
-  while ((ADCSRA & (1 << ADSC)) != 0) {
+  /// One conversion for the initialization of the ADC
+  convert();
+
+  /// Actual conversion
+  convert();
+
+  uint16_t value = ADC;
+
+  if (powerMode != ALWAYS_ON) {
+    /// Disable the ADC before shutting it down
+    ADCSRA &= ~(1 << ADEN);
+#if defined(__AVR_HAVE_PRR_PRADC)
+    power_adc_disable();
+#endif
   }
 
-  /// Activate ADC
-  ADCSRA |= (1 << ADSC);
+  return (float)linearRegression->calculate(value);
+}
 
-  /// Wait until conversion is finished
-  while ((ADCSRA & (1 << ADSC)) != 0) {
+bool AVRInternalTemperatureSensor::update(uint32_t now) {
+  if (sampled && now - lastSampleTime < sampleInterval) {
+    return false;
   }
 
-  return (float)linearRegression->calculate(ADC);
+  lastTemperature = getTemperature();
+  lastSampleTime = now;
+  sampled = true;
+  return true;
+}
+
+uint32_t AVRInternalTemperatureSensor::getOnTimePerReading() {
+#if defined(F_CPU)
+  /// The ADC is already enabled in the mode ALWAYS_ON, so the conversion for
+  /// the initialization takes as long as the actual conversion
+  uint32_t cycles = (powerMode == ALWAYS_ON ? ADC_CYCLES_CONVERSION
+                                            : ADC_CYCLES_FIRST_CONVERSION) +
+                    ADC_CYCLES_CONVERSION;
+  return cycles * ADC_PRESCALER * 1000UL / (F_CPU / 1000);
+#else
+  return 0;
+#endif
 }
 
 void AVRInternalTemperatureSensor::saveState() {
@@ -95,14 +184,14 @@ void AVRInternalTemperatureSensor::saveState() {
     defined(__AVR_ATmega88A__) || defined(__AVR_ATmega88PA__) ||               \
     defined(__AVR_ATmega168A__) || defined(__AVR_ATmega168PA__) ||             \
     defined(__AVR_ATmega328__) || defined(__AVR_ATmega328P__)
-  this->stateStorage =
-      (int *)malloc(sizeof(ADMUX) + sizeof(ADCSRA) + sizeof(PRR));
+  /// ADMUX, ADCSRA, PRR
+  this->stateStorage = (int *)malloc(3 * sizeof(int));
   this->stateStorage[0] = ADMUX;
   this->stateStorage[1] = ADCSRA;
   this->stateStorage[2] = PRR;
 #elif defined(__AVR_ATtiny828__)
-  this->stateStorage = (int *)malloc(sizeof(ADMUXA) + sizeof(ADMUXB) +
-                                     sizeof(ADCSRA) + sizeof(PRR));
+  /// ADMUXA, ADMUXB, ADCSRA, PRR
+  this->stateStorage = (int *)malloc(4 * sizeof(int));
   this->stateStorage[0] = ADMUXA;
   this->stateStorage[1] = ADMUXB;
   this->stateStorage[2] = ADCSRA;
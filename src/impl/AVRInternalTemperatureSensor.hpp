@@ -29,13 +29,27 @@
 #include "TemperatureSensor.hpp"
 
 #include <Linear2DRegression.hpp>
+#include <stdint.h>
 
 /*!
  * @brief   Class representing the Internal Temperature Sensor of
  * microprocessors from Microchip (formerly: Atmel) with AVR Platform.
  */
 class AVRInternalTemperatureSensor : public TemperatureSensor {
+public:
+  enum PowerMode {
+    ALWAYS_ON,
+    DUTY_CYCLED,
+    DUTY_CYCLED_NOISE_REDUCTION
+  }; /// Power handling of the ADC
+
 private:
+  PowerMode powerMode = ALWAYS_ON; /// Power handling of the ADC
+  uint32_t sampleInterval = 0;     /// Time between two readings in ms
+  uint32_t lastSampleTime = 0;     /// Time of the last reading in ms
+  bool sampled = false;            /// True, if a reading was taken
+  float lastTemperature = 0;       /// Temperature of the last reading
+
   static Linear2DRegression
       *linearRegression; /// Regression needed for calculating the temperature
                          /// of the voltage
@@ -50,6 +64,12 @@ private:
    */
   static void initRegression();
 
+  /*!
+   * @brief Start a conversion and wait until it is finished. In the mode
+   * DUTY_CYCLED_NOISE_REDUCTION the MCU sleeps during the conversion.
+   */
+  void convert();
+
 public:
   /*!
    * @copydoc TemperatureSensor::init()
@@ -66,6 +86,70 @@ public:
    */
   float getTemperature() override;
 
+  /*!
+   * @brief Set the power handling of the ADC. In the mode ALWAYS_ON the ADC
+   * stays enabled after a reading. In the duty-cycled modes the ADC is powered
+   * up via the Power Reduction Register for each reading and powered down
+   * afterwards. DUTY_CYCLED_NOISE_REDUCTION additionally converts in the ADC
+   * Noise Reduction sleep mode, which requires the build flag
+   * TEMPERATURE_LIBRARY_ADC_NOISE_REDUCTION. This flag also defines an empty
+   * ADC_vect interrupt for waking up, unless
+   * TEMPERATURE_LIBRARY_NO_ADC_INTERRUPT is defined because the sketch
+   * implements it. Without the flag, or if the interrupts are disabled when
+   * reading, DUTY_CYCLED_NOISE_REDUCTION behaves like DUTY_CYCLED. The sleep
+   * mode halts clkIO, so the peripherals using it (e.g. the USART and Timer0,
+   * which drives millis()) pause during each conversion. Flush outgoing serial
+   * data before reading.
+   *
+   * @param mode    Power mode
+   */
+  void setPowerMode(PowerMode mode) { this->powerMode = mode; }
+
+  /*!
+   * @brief Get the power handling of the ADC.
+   *
+   * @return Power mode
+   */
+  PowerMode getPowerMode() { return powerMode; }
+
+  /*!
+   * @brief Set the desired sample rate used by update().
+   *
+   * @param interval    Time between two readings in milliseconds.
+   */
+  void setSampleInterval(uint32_t interval) {
+    this->sampleInterval = interval;
+  }
+
+  /*!
+   * @brief Take a reading, if the sample interval has elapsed since the last
+   * one. Call it frequently, e.g. with millis() in loop(). The overflow of the
+   * time is handled.
+   *
+   * @param now     Current time in milliseconds.
+   * @return True, if a new reading was taken.
+   */
+  bool update(uint32_t now);
+
+  /*!
+   * @brief Get the temperature of the last reading taken by update().
+   *
+   * @return Temperature value
+   */
+  float getLastTemperature() { return lastTemperature; }
+
+  /*!
+   * @brief Get the estimated time the ADC is converting for one reading in the
+   * current power mode. In the duty-cycled modes the ADC is enabled for each
+   * reading, so the first conversion takes longer, and this is the time the
+   * ADC is powered per reading. In the mode ALWAYS_ON the ADC stays enabled,
+   * so the estimate applies from the second reading on and the ADC
+   * additionally draws current between the readings.
+   *
+   * @return On-time in microseconds, 0 if F_CPU is unknown.
+   */
+  uint32_t getOnTimePerReading();
+
   /*!
    * @copydoc TemperatureSensor::saveState()
    */
@@ -0,0 +1,130 @@
+/*!
+ * @file AVRInternalTemperatureSensorTest.cpp
+ *
+ * Host tests of the power modes of the AVR internal temperature sensor against
+ * mocked registers. Built with and without
+ * TEMPERATURE_LIBRARY_ADC_NOISE_REDUCTION.
+ */
+
+#include "Test.hpp"
+
+#include "avr/interrupt.h"
+#include "avr/io.h"
+#include "impl/AVRInternalTemperatureSensor.hpp"
+
+#if !defined(TEMPERATURE_LIBRARY_ADC_NOISE_REDUCTION)
+/// Interrupt of the sketch, which must not collide with the library
+ISR(ADC_vect) {}
+#endif
+
+/** ADC result of 25 degrees according to the datasheet. The regression over
+ * all datasheet points deviates from it by about 1.5 degrees. */
+static const uint16_t ADC_25_DEGREES = 314;
+
+/*!
+ * @brief Take a reading with freshly reset registers.
+ */
+static float read(AVRInternalTemperatureSensor *sensor, uint8_t sreg) {
+  mockAVR.reset();
+  mockAVR.result = ADC_25_DEGREES;
+  SREG = sreg;
+  return sensor->getTemperature();
+}
+
+static void testAlwaysOn(AVRInternalTemperatureSensor *sensor) {
+  sensor->setPowerMode(AVRInternalTemperatureSensor::ALWAYS_ON);
+
+  CHECK_NEAR(read(sensor, 1 << SREG_I), 25, 2);
+  CHECK(mockAVR.conversions == 2);
+  CHECK(mockAVR.conversionsPoweredDown == 0);
+  CHECK(mockAVR.conversionsWithoutEnable == 0);
+  CHECK(mockAVR.sleeps == 0);
+  /// ADC stays powered and enabled
+  CHECK((PRR & (1 << PRADC)) == 0);
+  CHECK((ADCSRA.value & (1 << ADEN)) != 0);
+  CHECK(ADMUX == ((1 << REFS1) | (1 << REFS0) | (1 << MUX3)));
+
+  /// 13 + 13 ADC cycles with a prescaler of 64 at 16 MHz
+  CHECK(sensor->getOnTimePerReading() == 104);
+}
+
+static void testDutyCycled(AVRInternalTemperatureSensor *sensor) {
+  sensor->setPowerMode(AVRInternalTemperatureSensor::DUTY_CYCLED);
+
+  CHECK_NEAR(read(sensor, 1 << SREG_I), 25, 2);
+  CHECK(mockAVR.conversions == 2);
+  /// PRADC cleared before and set after the reading, ADEN dropped
+  CHECK(mockAVR.conversionsPoweredDown == 0);
+  CHECK(mockAVR.conversionsWithoutEnable == 0);
+  CHECK((PRR & (1 << PRADC)) != 0);
+  CHECK((ADCSRA.value & (1 << ADEN)) == 0);
+  CHECK(mockAVR.sleeps == 0);
+
+  /// 25 + 13 ADC cycles with a prescaler of 64 at 16 MHz
+  CHECK(sensor->getOnTimePerReading() == 152);
+}
+
+static void testNoiseReduction(AVRInternalTemperatureSensor *sensor) {
+  sensor->setPowerMode(
+      AVRInternalTemperatureSensor::DUTY_CYCLED_NOISE_REDUCTION);
+
+  /// Interrupts enabled before, with other flags of the status register set
+  CHECK_NEAR(read(sensor, (1 << SREG_I) | (1 << 1)), 25, 2);
+  CHECK(mockAVR.conversions == 2);
+  CHECK(mockAVR.conversionsPoweredDown == 0);
+  CHECK(mockAVR.conversionsWithoutEnable == 0);
+  CHECK((PRR & (1 << PRADC)) != 0);
+  CHECK((ADCSRA.value & (1 << ADEN)) == 0);
+  CHECK((ADCSRA.value & (1 << ADIE)) == 0);
+  CHECK(SREG == ((1 << SREG_I) | (1 << 1)));
+  CHECK(!mockAVR.sleepEnabled);
+#if defined(TEMPERATURE_LIBRARY_ADC_NOISE_REDUCTION)
+  CHECK(mockAVR.sleeps == 2);
+  CHECK(mockAVR.invalidSleeps == 0);
+#else
+  CHECK(mockAVR.sleeps == 0);
+#endif
+
+  /// Interrupts disabled before (e.g. in an ISR), so no sleeping and the
+  /// interrupts are never enabled during the reading
+  CHECK_NEAR(read(sensor, 0), 25, 2);
+  CHECK(mockAVR.conversions == 2);
+  CHECK(mockAVR.sleeps == 0);
+  CHECK(mockAVR.interruptEnables == 0);
+  CHECK(SREG == 0);
+  CHECK((ADCSRA.value & (1 << ADIE)) == 0);
+  CHECK((PRR & (1 << PRADC)) != 0);
+
+  CHECK(sensor->getOnTimePerReading() == 152);
+}
+
+static void testUpdate(AVRInternalTemperatureSensor *sensor) {
+  sensor->setPowerMode(AVRInternalTemperatureSensor::DUTY_CYCLED);
+  sensor->setSampleInterval(1000);
+  mockAVR.reset();
+  mockAVR.result = ADC_25_DEGREES;
+
+  /// First call always takes a reading
+  CHECK(sensor->update(0xFFFFFE00));
+  CHECK_NEAR(sensor->getLastTemperature(), 25, 2);
+  CHECK(!sensor->update(0xFFFFFFFF));
+  /// millis() overflows, 0x300 ms elapsed
+  CHECK(!sensor->update(0x00000100));
+  /// 1000 ms elapsed
+  CHECK(sensor->update(0x000001E8));
+  CHECK(!sensor->update(0x000005CF));
+  CHECK(sensor->update(0x000005D0));
+  CHECK(mockAVR.conversions == 6);
+}
+
+int main() {
+  AVRInternalTemperatureSensor *sensor = new AVRInternalTemperatureSensor();
+  sensor->init();
+
+  testAlwaysOn(sensor);
+  testDutyCycled(sensor);
+  testNoiseReduction(sensor);
+  testUpdate(sensor);
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,20 @@
+/*!
+ * @file SizeReport.cpp
+ *
+ * Minimal program using the conversion and string methods, linked by
+ * size.sh to measure the flash footprint on AVR.
+ */
+
+#include "Temperature.hpp"
+
+/** Inputs the compiler cannot know. */
+volatile float value;
+volatile Temperature::Unit unitFrom;
+volatile Temperature::Unit unitTo;
+volatile String unitString;
+
+int main() {
+  value = Temperature::convertTo(value, unitFrom, unitTo);
+  unitString = Temperature::getUnitString(unitTo);
+  return 0;
+}
@@ -0,0 +1,152 @@
+/*!
+ * @file TemperatureFilterTest.cpp
+ *
+ * Host tests of the step response and the noise reduction of the filters.
+ */
+
+#include "Test.hpp"
+
+#include "MockTemperatureSensor.hpp"
+#include "filter/ExponentialTemperatureFilter.hpp"
+#include "filter/KalmanTemperatureFilter.hpp"
+
+/** Resolution of the filters (1/64 degree). */
+static const float LSB = (float)1 / 64;
+
+/*!
+ * @brief Step the sensor from one temperature to another.
+ *
+ * @return Number of readings until the output reached 90% of the step.
+ */
+static int step(TemperatureFilter &filter, MockTemperatureSensor &sensor,
+                float from, float to) {
+  sensor.value = from;
+  filter.init();
+  for (int i = 0; i < 10; i++) {
+    filter.getTemperature();
+  }
+
+  sensor.value = to;
+  for (int i = 1; i < 100000; i++) {
+    float value = filter.getTemperature();
+    if ((to - value) / (to - from) <= (float)0.1) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/*!
+ * @brief Settle the filter on the current temperature.
+ *
+ * @return Output after the given number of readings.
+ */
+static float settle(TemperatureFilter &filter, int readings) {
+  float value = 0;
+  for (int i = 0; i < readings; i++) {
+    value = filter.getTemperature();
+  }
+  return value;
+}
+
+/*!
+ * @brief Measure the variance of the output with a noisy sensor.
+ */
+static float variance(TemperatureFilter &filter, MockTemperatureSensor &sensor) {
+  const int readings = 5000;
+  sensor.value = 20;
+  sensor.noise = true;
+  filter.init();
+  settle(filter, 500);
+
+  float sum = 0;
+  float sumSquares = 0;
+  for (int i = 0; i < readings; i++) {
+    float value = filter.getTemperature() - sensor.value;
+    sum += value;
+    sumSquares += value * value;
+  }
+  sensor.noise = false;
+
+  float mean = sum / readings;
+  return sumSquares / readings - mean * mean;
+}
+
+/*!
+ * @brief Measure the variance of the unfiltered noisy sensor.
+ */
+static float rawVariance(MockTemperatureSensor &sensor) {
+  const int readings = 5000;
+  sensor.value = 20;
+  sensor.noise = true;
+
+  float sumSquares = 0;
+  for (int i = 0; i < readings; i++) {
+    float value = sensor.getTemperature() - sensor.value;
+    sumSquares += value * value;
+  }
+  sensor.noise = false;
+
+  return sumSquares / readings;
+}
+
+static void testExponential(MockTemperatureSensor &sensor) {
+  ExponentialTemperatureFilter filter(&sensor, 4);
+
+  /// 90% of a step after about ln(10) * 2^4 readings
+  int readings = step(filter, sensor, 30, 20);
+  CHECK(readings >= 30 && readings <= 45);
+  CHECK_NEAR(settle(filter, 1000), 20, 0);
+
+  readings = step(filter, sensor, 20, 30);
+  CHECK(readings >= 30 && readings <= 45);
+  CHECK_NEAR(settle(filter, 1000), 30, 0);
+
+  step(filter, sensor, -20, -40);
+  CHECK_NEAR(settle(filter, 1000), -40, 0);
+
+  CHECK(variance(filter, sensor) < rawVariance(sensor) / 10);
+
+  ExponentialTemperatureFilter unfiltered(&sensor, 0);
+  CHECK(step(unfiltered, sensor, 30, 20) == 1);
+}
+
+static void testKalman(MockTemperatureSensor &sensor) {
+  KalmanTemperatureFilter filter(&sensor, 1, 100);
+
+  /// 90% of a step after about ln(10) / K readings, the gain K is still above
+  /// its steady state of about 0.1 shortly after the initialization
+  int readings = step(filter, sensor, 30, 20);
+  CHECK(readings >= 10 && readings <= 30);
+  CHECK_NEAR(settle(filter, 5000), 20, LSB);
+
+  readings = step(filter, sensor, 20, 30);
+  CHECK(readings >= 10 && readings <= 30);
+  CHECK_NEAR(settle(filter, 5000), 30, LSB);
+
+  step(filter, sensor, -20, -40);
+  CHECK_NEAR(settle(filter, 5000), -40, LSB);
+
+  CHECK(variance(filter, sensor) < rawVariance(sensor) / 10);
+
+  /// Strong smoothing must not leave a dead band
+  KalmanTemperatureFilter smooth(&sensor, 1, 10000);
+  readings = step(smooth, sensor, 30, 20);
+  CHECK(readings >= 50 && readings <= 100);
+  CHECK_NEAR(settle(smooth, 100000), 20, LSB);
+
+  /// Without process noise the filter must still follow a change
+  KalmanTemperatureFilter constant(&sensor, 0, 100);
+  readings = step(constant, sensor, 30, 20);
+  CHECK(readings >= 15 && readings <= 35);
+  CHECK_NEAR(settle(constant, 100000), 20, LSB);
+}
+
+int main() {
+  MockTemperatureSensor sensor;
+
+  testExponential(sensor);
+  testKalman(sensor);
+
+  return TEST_RESULT();
+}
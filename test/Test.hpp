@@ -0,0 +1,41 @@
+/*!
+ * @file Test.hpp
+ *
+ * Minimal assertion helpers for the host tests.
+ */
+
+#ifndef TEMPERATURE_LIBRARY_TEST_TEST_HPP
+#define TEMPERATURE_LIBRARY_TEST_TEST_HPP
+
+#include <stdio.h>
+
+static int failures = 0; /// Number of failed checks
+
+/** Check a condition and report it, if it does not hold. */
+#define CHECK(condition)                                                       \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);    \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+/** Check that two floats differ by at most the tolerance. */
+#define CHECK_NEAR(actual, expected, tolerance)                                \
+  do {                                                                         \
+    float checkActual = (actual);                                              \
+    float checkExpected = (expected);                                          \
+    if (checkActual - checkExpected > (tolerance) ||                           \
+        checkExpected - checkActual > (tolerance)) {                           \
+      printf("%s:%d: check failed: %s = %f, expected %f\n", __FILE__,         \
+             __LINE__, #actual, checkActual, checkExpected);                   \
+      failures++;                                                              \
+    }                                                                          \
+  } while (0)
+
+/** Print the result and return the exit code of the test. */
+#define TEST_RESULT()                                                          \
+  (printf("%s: %s\n", __FILE__, failures == 0 ? "passed" : "FAILED"),          \
+   failures == 0 ? 0 : 1)
+
+#endif // TEMPERATURE_LIBRARY_TEST_TEST_HPP
@@ -0,0 +1,33 @@
+/*!
+ * @file mock/Linear2DRegression.hpp
+ *
+ * Least squares regression replacing the Regression library for the host
+ * tests.
+ */
+
+#ifndef TEMPERATURE_LIBRARY_TEST_LINEAR2DREGRESSION_HPP
+#define TEMPERATURE_LIBRARY_TEST_LINEAR2DREGRESSION_HPP
+
+/*!
+ * @brief   Linear regression through the added points.
+ */
+class Linear2DRegression {
+private:
+  double n = 0, sumX = 0, sumY = 0, sumXX = 0, sumXY = 0; /// Sums of points
+
+public:
+  void addPoint(double x, double y) {
+    n++;
+    sumX += x;
+    sumY += y;
+    sumXX += x * x;
+    sumXY += x * y;
+  }
+
+  double calculate(double x) {
+    double slope = (n * sumXY - sumX * sumY) / (n * sumXX - sumX * sumX);
+    return slope * x + (sumY - slope * sumX) / n;
+  }
+};
+
+#endif // TEMPERATURE_LIBRARY_TEST_LINEAR2DREGRESSION_HPP
@@ -0,0 +1,44 @@
+/*!
+ * @file mock/MockTemperatureSensor.hpp
+ *
+ * Temperature sensor for the host tests, returning a configurable temperature
+ * with optional deterministic noise.
+ */
+
+#ifndef TEMPERATURE_LIBRARY_TEST_MOCKTEMPERATURESENSOR_HPP
+#define TEMPERATURE_LIBRARY_TEST_MOCKTEMPERATURESENSOR_HPP
+
+#include "TemperatureSensor.hpp"
+
+#include <stdint.h>
+
+/*!
+ * @brief   Mock sensor returning the set temperature plus -1, 0 or +1 (if
+ * noise is enabled).
+ */
+class MockTemperatureSensor : public TemperatureSensor {
+private:
+  uint32_t seed = 1; /// State of the pseudo random generator
+
+public:
+  float value = 0;    /// Temperature without noise
+  bool noise = false; /// True, if noise is added to the readings
+
+  void init() override {}
+
+  Temperature::Unit getDefaultUnit() override { return Temperature::CELSIUS; }
+
+  float getTemperature() override {
+    if (!noise) {
+      return value;
+    }
+    seed = seed * 1103515245 + 12345;
+    return value + (float)((int)((seed >> 16) % 3) - 1);
+  }
+
+  void saveState() override {}
+
+  void restoreState() override {}
+};
+
+#endif // TEMPERATURE_LIBRARY_TEST_MOCKTEMPERATURESENSOR_HPP
@@ -0,0 +1,61 @@
+/*!
+ * @file mock/avr/MockAVR.cpp
+ *
+ * Behaviour of the mocked registers for the host tests.
+ */
+
+#include "io.h"
+#include "sleep.h"
+
+uint8_t PRR;
+uint8_t ADMUX;
+uint8_t SREG;
+uint16_t ADC;
+MockADCSRA ADCSRA;
+MockAVR mockAVR;
+
+MockADCSRA::operator uint8_t() {
+  if ((value & (1 << ADSC)) != 0 && !mockAVR.sleepEnabled) {
+    mockAVR.finishConversion();
+  }
+  return value;
+}
+
+MockADCSRA &MockADCSRA::operator=(uint8_t value) {
+  if ((value & (1 << ADSC)) != 0 && (this->value & (1 << ADSC)) == 0) {
+    if ((PRR & (1 << PRADC)) != 0) {
+      mockAVR.conversionsPoweredDown++;
+    }
+    if ((value & (1 << ADEN)) == 0) {
+      mockAVR.conversionsWithoutEnable++;
+    }
+  }
+  this->value = value;
+  return *this;
+}
+
+void MockAVR::reset() {
+  *this = MockAVR();
+  PRR = (1 << PRADC);
+  ADMUX = 0;
+  SREG = (1 << SREG_I);
+  ADC = 0;
+  ADCSRA.value = 0;
+}
+
+void MockAVR::finishConversion() {
+  ADCSRA.value &= (uint8_t) ~(1 << ADSC);
+  ADC = result;
+  conversions++;
+}
+
+void sleep_cpu() {
+  mockAVR.sleeps++;
+  if ((SREG & (1 << SREG_I)) == 0 || !mockAVR.sleepEnabled ||
+      (ADCSRA.value & (1 << ADIE)) == 0) {
+    mockAVR.invalidSleeps++;
+  }
+  if ((ADCSRA.value & (1 << ADSC)) != 0) {
+    mockAVR.finishConversion();
+  }
+}
@@ -0,0 +1,23 @@
+/*!
+ * @file mock/avr/interrupt.h
+ *
+ * Mocked interrupt handling for the host tests. Interrupt vectors become plain
+ * functions, so a duplicate definition fails to link like on the MCU.
+ */
+
+#ifndef TEMPERATURE_LIBRARY_TEST_AVR_INTERRUPT_H
+#define TEMPERATURE_LIBRARY_TEST_AVR_INTERRUPT_H
+
+#include "io.h"
+
+#define ISR(vector) void vector()
+#define EMPTY_INTERRUPT(vector)                                                \
+  void vector() {}
+
+inline void cli() { SREG &= (uint8_t) ~(1 << SREG_I); }
+inline void sei() {
+  SREG |= (uint8_t)(1 << SREG_I);
+  mockAVR.interruptEnables++;
+}
+
+#endif // TEMPERATURE_LIBRARY_TEST_AVR_INTERRUPT_H
@@ -0,0 +1,75 @@
+/*!
+ * @file mock/avr/io.h
+ *
+ * Mocked registers of an ATmega328P for the host tests.
+ */
+
+#ifndef TEMPERATURE_LIBRARY_TEST_AVR_IO_H
+#define TEMPERATURE_LIBRARY_TEST_AVR_IO_H
+
+#include <stdint.h>
+
+#define __AVR_ATmega328P__
+
+#define SREG_I 7
+
+#define PRADC 0
+
+#define REFS1 7
+#define REFS0 6
+#define MUX3 3
+
+#define ADEN 7
+#define ADSC 6
+#define ADIE 3
+#define ADPS2 2
+#define ADPS1 1
+#define ADPS0 0
+
+/*!
+ * @brief   ADCSRA register. Starting a conversion is recorded, and a running
+ * conversion finishes when the register is polled without sleeping.
+ */
+class MockADCSRA {
+public:
+  uint8_t value = 0; /// Register value
+
+  operator uint8_t();
+  MockADCSRA &operator=(uint8_t value);
+  MockADCSRA &operator|=(uint8_t value) { return *this = this->value | value; }
+  MockADCSRA &operator&=(int value) { return *this = this->value & value; }
+};
+
+extern uint8_t PRR;
+extern uint8_t ADMUX;
+extern uint8_t SREG;
+extern uint16_t ADC;
+extern MockADCSRA ADCSRA;
+
+/*!
+ * @brief   Recorded behaviour of the mocked MCU.
+ */
+struct MockAVR {
+  uint16_t result = 0;              /// Result of every conversion
+  int conversions = 0;              /// Finished conversions
+  int conversionsPoweredDown = 0;   /// Conversions started while PRADC was set
+  int conversionsWithoutEnable = 0; /// Conversions started while ADEN was clear
+  int sleeps = 0;                   /// Calls of sleep_cpu()
+  int invalidSleeps = 0;            /// Sleeps without interrupts/sleep/ADIE
+  int interruptEnables = 0;         /// Calls of sei()
+  bool sleepEnabled = false;        /// True, if sleep_enable() was called
+
+  /*!
+   * @brief Reset the registers and the recorded behaviour.
+   */
+  void reset();
+
+  /*!
+   * @brief Finish the running conversion.
+   */
+  void finishConversion();
+};
+
+extern MockAVR mockAVR;
+
+#endif // TEMPERATURE_LIBRARY_TEST_AVR_IO_H
@@ -0,0 +1,12 @@
+/*!
+ * @file mock/avr/pgmspace.h
+ *
+ * Program memory strings for the host builds, which are plain strings.
+ */
+
+#ifndef TEMPERATURE_LIBRARY_TEST_AVR_PGMSPACE_H
+#define TEMPERATURE_LIBRARY_TEST_AVR_PGMSPACE_H
+
+#define PSTR(s) (s)
+
+#endif // TEMPERATURE_LIBRARY_TEST_AVR_PGMSPACE_H
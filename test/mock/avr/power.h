@@ -0,0 +1,17 @@
+/*!
+ * @file mock/avr/power.h
+ *
+ * Mocked power reduction of an ATmega328P for the host tests.
+ */
+
+#ifndef TEMPERATURE_LIBRARY_TEST_AVR_POWER_H
+#define TEMPERATURE_LIBRARY_TEST_AVR_POWER_H
+
+#include "io.h"
+
+#define __AVR_HAVE_PRR_PRADC
+
+#define power_adc_enable() (PRR &= (uint8_t) ~(1 << PRADC))
+#define power_adc_disable() (PRR |= (uint8_t)(1 << PRADC))
+
+#endif // TEMPERATURE_LIBRARY_TEST_AVR_POWER_H
@@ -0,0 +1,20 @@
+/*!
+ * @file mock/avr/sleep.h
+ *
+ * Mocked sleep modes for the host tests. Sleeping finishes the running
+ * conversion, like the ADC interrupt would wake up the MCU.
+ */
+
+#ifndef TEMPERATURE_LIBRARY_TEST_AVR_SLEEP_H
+#define TEMPERATURE_LIBRARY_TEST_AVR_SLEEP_H
+
+#include "io.h"
+
+#define SLEEP_MODE_ADC 1
+
+inline void set_sleep_mode(uint8_t) {}
+inline void sleep_enable() { mockAVR.sleepEnabled = true; }
+inline void sleep_disable() { mockAVR.sleepEnabled = false; }
+void sleep_cpu();
+
+#endif // TEMPERATURE_LIBRARY_TEST_AVR_SLEEP_H
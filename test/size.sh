@@ -0,0 +1,46 @@
+#!/bin/sh
+# Code size of the conversion and string methods for different unit
+# selections. Run with: make -C test size
+#
+# host: text of Temperature.o built with the host compiler. This is only a
+#       relative comparison and not the flash footprint on AVR.
+# avr:  text + data of a minimal program (SizeReport.cpp) linked for the
+#       ATtiny828, including the software floating point routines. Only
+#       measured if avr-g++ is available.
+
+set -e
+
+cd "$(dirname "$0")"
+
+CXX="${CXX:-g++}"
+MCU="${MCU:-attiny828}"
+FLAGS="-std=gnu++11 -Os -ffunction-sections -fdata-sections"
+BUILD="build/size"
+
+mkdir -p "$BUILD"
+
+report() {
+  name="$1"
+  units="$2"
+
+  "$CXX" $FLAGS -I../src -Imock $units -c ../src/Temperature.cpp \
+    -o "$BUILD/Temperature.o"
+  host=$(size "$BUILD/Temperature.o" | awk 'NR == 2 { print $1 }')
+
+  avr="-"
+  if command -v avr-g++ >/dev/null 2>&1; then
+    avr-g++ -mmcu="$MCU" $FLAGS -Wl,--gc-sections -I../src $units \
+      SizeReport.cpp ../src/Temperature.cpp -o "$BUILD/SizeReport.elf"
+    avr=$(avr-size "$BUILD/SizeReport.elf" | awk 'NR == 2 { print $1 + $2 }')
+  fi
+
+  printf '| %-22s | %-11s | %-16s |\n' "$name" "$host" "$avr"
+}
+
+echo "AVR: $MCU"
+printf '| %-22s | %-11s | %-16s |\n' "Units" "Host (text)" "AVR (flash)"
+printf '|------------------------|-------------|------------------|\n'
+report "all (default)" ""
+report "Celsius and Fahrenheit" \
+  "-DTEMPERATURE_LIBRARY_UNIT_CELSIUS -DTEMPERATURE_LIBRARY_UNIT_FAHRENHEIT"
+report "Celsius only" "-DTEMPERATURE_LIBRARY_UNIT_CELSIUS"